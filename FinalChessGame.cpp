@@ -1,10 +1,27 @@
 
+// Define CHESS_HEADLESS before including this file to get only the rules
+// (no window, no textures, no main) - used by the tools in bench/.
+#ifndef CHESS_HEADLESS
 #include <SFML/Graphics.hpp>
+#endif
 #include <iostream>
+#include <sstream>
+#include <string>
 
+#ifndef CHESS_HEADLESS
 using namespace sf;
+#endif
 using namespace std;
 
+// Game state is per-thread in headless builds so the bench tools can
+// search several positions at once.
+#ifdef CHESS_HEADLESS
+#define CHESS_STATE thread_local
+struct Sprite { void setPosition(float, float) {} };
+#else
+#define CHESS_STATE
+#endif
+
 //////////  SETTINGS //////////
 const int CELL = 100;
 const int BOARD_N = 8;
@@ -12,8 +29,10 @@ const int WINDOW_W = CELL * BOARD_N;
 const int WINDOW_H = CELL * BOARD_N;
 
 //////////  SECTION: TEXTURES & SPRITES (all pieces)  //////////
+#ifndef CHESS_HEADLESS
 Texture w_pawn, w_rock, w_knight, w_bishop, w_queen, w_king;
 Texture b_pawn, b_rock, b_knight, b_bishop, b_queen, b_king;
+#endif
 
 Sprite s_w_pawn, s_w_rock, s_w_knight, s_w_bishop, s_w_queen, s_w_king;
 Sprite s_b_pawn, s_b_rock, s_b_knight, s_b_bishop, s_b_queen, s_b_king;
@@ -37,32 +56,32 @@ struct Piece {
     }
 };
 
-Piece pieces[32]{};
-int pieceCount = 0;
+CHESS_STATE Piece pieces[32]{};
+CHESS_STATE int pieceCount = 0;
 
 int draggingIndex = -1;
-bool whiteTurn = true;
+CHESS_STATE bool whiteTurn = true;
 
-bool highlightMode = false;
-int highlightPieceIndex = -1;
+CHESS_STATE bool highlightMode = false;
+CHESS_STATE int highlightPieceIndex = -1;
 
-bool validMoves[8][8];
-bool captureMoves[8][8];
+CHESS_STATE bool validMoves[8][8];
+CHESS_STATE bool captureMoves[8][8];
 
-bool hoverMode = false;
-bool clickMode = false;
-int hoveredIndex = -1;
-int selectedIndex = -1;
+CHESS_STATE bool hoverMode = false;
+CHESS_STATE bool clickMode = false;
+CHESS_STATE int hoveredIndex = -1;
+CHESS_STATE int selectedIndex = -1;
 
-int lastMoveFromR = -1, lastMoveFromC = -1;
-int lastMoveToR = -1, lastMoveToC = -1;
+CHESS_STATE int lastMoveFromR = -1, lastMoveFromC = -1;
+CHESS_STATE int lastMoveToR = -1, lastMoveToC = -1;
 
 bool mousePressedFlag = false;
 int pressCellR = -1, pressCellC = -1;
 int pressMouseX = 0, pressMouseY = 0;
 
 //////////  SECTION: BOARD SETUP  //////////
-char boardArr[8][8] = {
+CHESS_STATE char boardArr[8][8] = {
     { 'r','n','b','q','k','b','n','r' },
     { 'p','p','p','p','p','p','p','p' },
     { '.','.','.','.','.','.','.','.' },
@@ -73,6 +92,7 @@ char boardArr[8][8] = {
     { 'R','N','B','Q','K','B','N','R' }
 };
 ////// CODE FOR TEXT ////////////////
+#ifndef CHESS_HEADLESS
 void drawBoardCoordinates(RenderWindow& window) {
     Font font;
     if (!font.loadFromFile("textures/abc.ttf")) {
@@ -97,6 +117,7 @@ void drawBoardCoordinates(RenderWindow& window) {
         window.draw(file);
     }
 }
+#endif
 
 
 
@@ -392,7 +413,86 @@ void initPieces() {
     addPiece(0, 3, false, 'Q', s_b_queen); addPiece(0, 4, false, 'K', s_b_king);
 }
 
+//////////  SECTION: LOAD POSITION FROM FEN  //////////
+Sprite& spriteFor(char pieceType, bool isWhite) {
+    switch (pieceType) {
+    case 'P': return isWhite ? s_w_pawn : s_b_pawn;
+    case 'R': return isWhite ? s_w_rock : s_b_rock;
+    case 'N': return isWhite ? s_w_knight : s_b_knight;
+    case 'B': return isWhite ? s_w_bishop : s_b_bishop;
+    case 'Q': return isWhite ? s_w_queen : s_b_queen;
+    default: return isWhite ? s_w_king : s_b_king;
+    }
+}
+
+// Only the piece placement and side-to-move fields are used; castling,
+// en passant and the clocks are ignored since the rules don't track them.
+bool loadFen(const string& fen) {
+    istringstream in(fen);
+    string placement, side;
+    if (!(in >> placement)) return false;
+    if (!(in >> side)) side = "w";
+    if (side != "w" && side != "b") return false;
+
+    char board[8][8];
+    int r = 0, c = 0;
+    for (char ch : placement) {
+        if (ch == '/') {
+            if (c != 8) return false;
+            ++r; c = 0;
+            continue;
+        }
+        if (r >= 8) return false;
+        if (ch >= '1' && ch <= '8') {
+            for (int k = 0; k < ch - '0'; ++k) { if (c >= 8) return false; board[r][c++] = '.'; }
+            continue;
+        }
+        char up = (ch >= 'a' && ch <= 'z') ? char(ch - ('a' - 'A')) : ch;
+        if (up != 'P' && up != 'R' && up != 'N' && up != 'B' && up != 'Q' && up != 'K') return false;
+        if (c >= 8) return false;
+        board[r][c++] = ch;
+    }
+    if (r != 7 || c != 8) return false;
+
+    // Exactly one king each and no pawns on the back ranks, otherwise the
+    // check/checkmate helpers give meaningless answers.
+    int count = 0, whiteKings = 0, blackKings = 0;
+    for (int rr = 0; rr < 8; ++rr) {
+        for (int cc = 0; cc < 8; ++cc) {
+            char ch = board[rr][cc];
+            if (ch == '.') continue;
+            ++count;
+            if (ch == 'K') ++whiteKings;
+            if (ch == 'k') ++blackKings;
+            if ((ch == 'P' || ch == 'p') && (rr == 0 || rr == 7)) return false;
+        }
+    }
+    if (count > 32 || whiteKings != 1 || blackKings != 1) return false;
+
+    pieceCount = 0;
+    for (int rr = 0; rr < 8; ++rr) {
+        for (int cc = 0; cc < 8; ++cc) {
+            char ch = board[rr][cc];
+            boardArr[rr][cc] = ch;
+            if (ch == '.') continue;
+            Piece& p = pieces[pieceCount++];
+            p = Piece();
+            p.row = rr;
+            p.col = cc;
+            p.white = (ch >= 'A' && ch <= 'Z');
+            p.alive = true;
+            p.type = p.white ? ch : char(ch - ('a' - 'A'));
+            p.sprite = spriteFor(p.type, p.white);
+            placeSpriteOnCell(p.sprite, rr, cc);
+        }
+    }
+    whiteTurn = (side == "w");
+    lastMoveFromR = lastMoveFromC = lastMoveToR = lastMoveToC = -1;
+    return true;
+}
+
 //////////  SECTION: MAIN  //////////
+#ifndef CHESS_HEADLESS
 int main() {
     RenderWindow window(VideoMode(WINDOW_W, WINDOW_H), "Chess - Fixed (MSVC)");
     window.setFramerateLimit(60);
@@ -650,6 +750,7 @@ int main() {
     }
     return 0;
 }
+#endif
 
 // --- Helper implementation for isKingInCheck (placed after main for clarity) ---
 bool isKingInCheck(bool kingIsWhite) {
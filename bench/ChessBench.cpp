@@ -0,0 +1,256 @@
+// Micro-benchmarks for the rules hot paths, headless (no SFML).
+//
+//   cmake -S . -B build && cmake --build build --target chess_bench
+//   build/chess_bench [--corpus FILE] [--samples N] [--warmup N] [--batch N] [--json FILE|-]
+//
+// Each sample times --batch whole passes over the corpus, then the same
+// number of baseline passes (restoring positions without the call) and
+// records (pass - baseline) / calls; the report gives percentiles over samples.
+#include "Headless.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+
+using Clock = chrono::steady_clock;
+
+//////////  SECTION: CORPUS  //////////
+const char* defaultCorpus[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r1bqkbnr/pppp1ppp/2n5/4p3/2B1P3/5Q2/PPPP1PPP/RNB1K1NR w KQkq - 4 4",
+    "r1bqk2r/pppp1ppp/2n2n2/2b1p3/2B1P3/3P1N2/PPP2PPP/RNBQK2R w KQkq - 1 5",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "2rr3k/pp3pp1/1nnqbN1p/3pN3/2pP4/2P3Q1/PPB4P/R4RK1 w - - 0 1",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 0 1",
+    "4k3/8/8/8/8/8/8/4K2Q b - - 0 1",
+    "3q1rk1/pb3ppp/1p2pn2/2p5/2PP4/P1QBPN2/5PPP/R4RK1 b - - 0 14",
+};
+
+struct Snapshot {
+    Piece pieces[32];
+    int pieceCount;
+    char board[8][8];
+    bool whiteTurn;
+};
+
+Snapshot takeSnapshot() {
+    Snapshot s;
+    for (int i = 0; i < 32; ++i) s.pieces[i] = pieces[i];
+    s.pieceCount = pieceCount;
+    memcpy(s.board, boardArr, sizeof(boardArr));
+    s.whiteTurn = whiteTurn;
+    return s;
+}
+
+void restoreSnapshot(const Snapshot& s) {
+    for (int i = 0; i < 32; ++i) pieces[i] = s.pieces[i];
+    pieceCount = s.pieceCount;
+    memcpy(boardArr, s.board, sizeof(boardArr));
+    whiteTurn = s.whiteTurn;
+}
+
+//////////  SECTION: RESULTS  //////////
+struct BenchResult {
+    string name;
+    long long callsPerSample;
+    vector<double> nsPerCall;
+};
+
+double percentile(const vector<double>& sorted, double pct) {
+    if (sorted.empty()) return 0.0;
+    size_t idx = size_t(pct / 100.0 * double(sorted.size() - 1) + 0.5);
+    return sorted[min(idx, sorted.size() - 1)];
+}
+
+volatile long long sink = 0;
+
+long long elapsedNs(Clock::time_point start) {
+    return chrono::duration_cast<chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+// pass() runs once over the corpus and returns how many calls it made.
+// baseline() repeats the same setup work (e.g. restoring positions) without
+// the call being measured; its time is subtracted. It may be empty.
+BenchResult runBench(const string& name, int warmup, int samples, int batch,
+    const function<long long()>& pass, const function<void()>& baseline) {
+    BenchResult res;
+    res.name = name;
+    res.callsPerSample = 0;
+    for (int w = 0; w < warmup; ++w) { pass(); if (baseline) baseline(); }
+    for (int s = 0; s < samples; ++s) {
+        long long calls = 0;
+        auto start = Clock::now();
+        for (int b = 0; b < batch; ++b) calls += pass();
+        long long timed = elapsedNs(start);
+        if (baseline) {
+            start = Clock::now();
+            for (int b = 0; b < batch; ++b) baseline();
+            timed -= elapsedNs(start);
+        }
+        res.callsPerSample = calls;
+        res.nsPerCall.push_back(calls ? max(0.0, double(timed) / double(calls)) : 0.0);
+    }
+    return res;
+}
+
+//////////  SECTION: REPORT  //////////
+void printTable(const vector<BenchResult>& results, size_t corpusSize) {
+    cout << "corpus: " << corpusSize << " positions" << endl;
+    cout << left << setw(22) << "benchmark" << right
+         << setw(12) << "calls/smp" << setw(10) << "min" << setw(10) << "p50"
+         << setw(10) << "p90" << setw(10) << "p99" << setw(10) << "max" << "   (ns/call)" << endl;
+    for (const BenchResult& r : results) {
+        vector<double> s = r.nsPerCall;
+        sort(s.begin(), s.end());
+        cout << left << setw(22) << r.name << right << setw(12) << r.callsPerSample << fixed << setprecision(1)
+             << setw(10) << s.front() << setw(10) << percentile(s, 50) << setw(10) << percentile(s, 90)
+             << setw(10) << percentile(s, 99) << setw(10) << s.back() << endl;
+    }
+}
+
+void writeJson(ostream& out, const vector<BenchResult>& results, size_t corpusSize, int warmup, int samples, int batch) {
+    out << "{\n";
+    out << "  \"corpus_positions\": " << corpusSize << ",\n";
+    out << "  \"warmup\": " << warmup << ",\n";
+    out << "  \"samples\": " << samples << ",\n";
+    out << "  \"batch\": " << batch << ",\n";
+    out << "  \"unit\": \"ns_per_call\",\n";
+    out << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        vector<double> s = r.nsPerCall;
+        sort(s.begin(), s.end());
+        double mean = 0.0;
+        for (double v : s) mean += v;
+        mean /= double(s.size());
+        out << fixed << setprecision(2);
+        out << "    { \"name\": \"" << r.name << "\", \"calls_per_sample\": " << r.callsPerSample
+            << ", \"min\": " << s.front() << ", \"mean\": " << mean
+            << ", \"p50\": " << percentile(s, 50) << ", \"p90\": " << percentile(s, 90)
+            << ", \"p99\": " << percentile(s, 99) << ", \"max\": " << s.back() << " }"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+//////////  SECTION: MAIN  //////////
+int main(int argc, char** argv) {
+    string corpusPath, jsonPath;
+    int samples = 200, warmup = 20, batch = 20;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--corpus" && hasValue) corpusPath = argv[++i];
+        else if (arg == "--json" && hasValue) jsonPath = argv[++i];
+        else if (arg == "--samples" && hasValue) samples = max(1, atoi(argv[++i]));
+        else if (arg == "--warmup" && hasValue) warmup = max(0, atoi(argv[++i]));
+        else if (arg == "--batch" && hasValue) batch = max(1, atoi(argv[++i]));
+        else {
+            cout << "usage: " << argv[0] << " [--corpus FILE] [--samples N] [--warmup N] [--batch N] [--json FILE|-]" << endl;
+            return 2;
+        }
+    }
+
+    vector<string> fens;
+    if (!corpusPath.empty()) {
+        if (!readLines(corpusPath, fens)) return 1;
+    }
+    else {
+        for (const char* f : defaultCorpus) fens.push_back(f);
+    }
+
+    vector<Snapshot> positions;
+    vector<Move> firstMove;
+    vector<Move> legal;
+    for (const string& fen : fens) {
+        if (!loadFen(fen)) {
+            cout << "Bad FEN: " << fen << endl;
+            return 1;
+        }
+        positions.push_back(takeSnapshot());
+        generateLegalMoves(whiteTurn, legal);
+        firstMove.push_back(legal.empty() ? Move{ -1, 0, 0, 0, 0, false } : legal.front());
+    }
+
+    vector<BenchResult> results;
+
+    auto restoreAll = [&]() {
+        for (const Snapshot& s : positions) { restoreSnapshot(s); sink += pieceCount; }
+        };
+
+    results.push_back(runBench("fen_parse", warmup, samples, batch, [&]() {
+        for (const string& fen : fens) sink += loadFen(fen);
+        return (long long)fens.size();
+        }, nullptr));
+
+    results.push_back(runBench("calculateValidMoves", warmup, samples, batch, [&]() {
+        long long calls = 0;
+        for (const Snapshot& s : positions) {
+            restoreSnapshot(s);
+            sink += pieceCount;
+            for (int i = 0; i < pieceCount; ++i) { calculateValidMoves(i); sink += validMoves[0][0]; }
+            calls += pieceCount;
+        }
+        return calls;
+        }, restoreAll));
+
+    results.push_back(runBench("isKingInCheck", warmup, samples, batch, [&]() {
+        for (const Snapshot& s : positions) {
+            restoreSnapshot(s);
+            sink += pieceCount;
+            sink += isKingInCheck(true);
+            sink += isKingInCheck(false);
+        }
+        return (long long)positions.size() * 2;
+        }, restoreAll));
+
+    results.push_back(runBench("hasAnyLegalMoves", warmup, samples, batch, [&]() {
+        for (const Snapshot& s : positions) {
+            restoreSnapshot(s);
+            sink += pieceCount;
+            sink += hasAnyLegalMoves(whiteTurn);
+        }
+        return (long long)positions.size();
+        }, restoreAll));
+
+    // Positions without a legal move are skipped in both passes.
+    results.push_back(runBench("performMove", warmup, samples, batch, [&]() {
+        long long calls = 0;
+        for (size_t p = 0; p < positions.size(); ++p) {
+            const Move& m = firstMove[p];
+            if (m.pieceIdx < 0) continue;
+            restoreSnapshot(positions[p]);
+            sink += pieceCount;
+            performMove(m.pieceIdx, m.toR, m.toC);
+            sink += boardArr[m.toR][m.toC];
+            ++calls;
+        }
+        return calls;
+        }, [&]() {
+            for (size_t p = 0; p < positions.size(); ++p) {
+                if (firstMove[p].pieceIdx < 0) continue;
+                restoreSnapshot(positions[p]);
+                sink += pieceCount;
+            }
+        }));
+
+    // With --json - stdout carries only the JSON so it can be piped.
+    if (jsonPath == "-") {
+        writeJson(cout, results, fens.size(), warmup, samples, batch);
+        return 0;
+    }
+    printTable(results, fens.size());
+    if (!jsonPath.empty()) {
+        ofstream out(jsonPath);
+        if (!out) {
+            cout << "Could not write " << jsonPath << endl;
+            return 1;
+        }
+        writeJson(out, results, fens.size(), warmup, samples, batch);
+    }
+    return 0;
+}
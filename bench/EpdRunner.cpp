@@ -0,0 +1,350 @@
+// EPD tactical-suite runner, headless (no SFML).
+//
+//   cmake -S . -B build && cmake --build build --target epd_runner
+//   build/epd_runner bench/tactics.epd [--threads N] [--time MS] [--depth N]
+//
+// Positions are searched concurrently, one per worker thread, each with its
+// own time limit. A position counts as solved when the final best move is
+// one of its "bm" moves (and none of its "am" moves). Time-to-solution is
+// when the search last switched to that move. Positions whose bm/am moves
+// are not legal under the game's rules (castling, promotion, en passant)
+// are reported as UNSUPPORTED and left out of the score.
+#include "Headless.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <thread>
+
+using Clock = chrono::steady_clock;
+
+//////////  SECTION: EPD PARSING  //////////
+struct EpdEntry {
+    string fen;
+    string id;
+    vector<string> bestMoves;
+    vector<string> avoidMoves;
+};
+
+vector<string> splitWords(const string& s) {
+    vector<string> words;
+    istringstream in(s);
+    string w;
+    while (in >> w) words.push_back(w);
+    return words;
+}
+
+// Position of the ';' ending the operation that starts at `start`,
+// skipping any inside quoted strings (id "a;b", c0 "...").
+size_t findOpEnd(const string& ops, size_t start) {
+    bool quoted = false;
+    for (size_t i = start; i < ops.size(); ++i) {
+        if (ops[i] == '"') quoted = !quoted;
+        else if (ops[i] == ';' && !quoted) return i;
+    }
+    return ops.size();
+}
+
+bool parseEpd(const string& line, EpdEntry& e) {
+    vector<string> words = splitWords(line);
+    if (words.size() < 4) return false;
+    e.fen = words[0] + " " + words[1] + " " + words[2] + " " + words[3];
+
+    // Operations follow the four FEN fields, each terminated by ';'.
+    size_t pos = 0;
+    for (int field = 0; field < 4; ++field) {
+        pos = line.find_first_not_of(" \t", pos);
+        pos = line.find_first_of(" \t", pos);
+    }
+    string ops = pos == string::npos ? "" : line.substr(pos);
+    size_t start = 0;
+    while (start < ops.size()) {
+        size_t end = findOpEnd(ops, start);
+        vector<string> op = splitWords(ops.substr(start, end - start));
+        start = end + 1;
+        if (op.empty()) continue;
+        if (op[0] == "bm") for (size_t i = 1; i < op.size(); ++i) e.bestMoves.push_back(stripSan(op[i]));
+        else if (op[0] == "am") for (size_t i = 1; i < op.size(); ++i) e.avoidMoves.push_back(stripSan(op[i]));
+        else if (op[0] == "id") {
+            for (size_t i = 1; i < op.size(); ++i) e.id += (i > 1 ? " " : "") + op[i];
+            e.id.erase(remove(e.id.begin(), e.id.end(), '"'), e.id.end());
+        }
+    }
+    return !e.bestMoves.empty() || !e.avoidMoves.empty();
+}
+
+//////////  SECTION: SEARCH  //////////
+const int MATE = 100000;
+const int MAX_PLY = 64;
+
+int pieceValue(char type) {
+    switch (type) {
+    case 'P': return 100;
+    case 'N': return 320;
+    case 'B': return 330;
+    case 'R': return 500;
+    case 'Q': return 900;
+    default: return 0;
+    }
+}
+
+// Material only, from the side to move's point of view.
+int evaluate() {
+    int score = 0;
+    for (int i = 0; i < pieceCount; ++i) {
+        if (!pieces[i].alive) continue;
+        int v = pieceValue(pieces[i].type);
+        score += pieces[i].white ? v : -v;
+    }
+    return whiteTurn ? score : -score;
+}
+
+struct SearchContext {
+    Clock::time_point deadline;
+    long long nodes = 0;
+    bool aborted = false;
+};
+
+bool timeUp(SearchContext& ctx) {
+    if (ctx.aborted) return true;
+    if ((++ctx.nodes & 1023) == 0 && Clock::now() >= ctx.deadline) ctx.aborted = true;
+    return ctx.aborted;
+}
+
+// Captures first, most valuable victim / least valuable attacker.
+void orderMoves(vector<Move>& moves) {
+    auto key = [](const Move& m) {
+        if (!m.capture) return 0;
+        int victim = findPieceIndexAt(m.toR, m.toC);
+        int victimValue = victim == -1 ? 0 : pieceValue(pieces[victim].type);
+        return 10 * victimValue - pieceValue(pieces[m.pieceIdx].type) / 10 + 1;
+    };
+    stable_sort(moves.begin(), moves.end(), [&](const Move& a, const Move& b) { return key(a) > key(b); });
+}
+
+int quiescence(SearchContext& ctx, int alpha, int beta, int ply) {
+    if (timeUp(ctx)) return 0;
+    int standPat = evaluate();
+    if (standPat >= beta) return standPat;
+    if (standPat > alpha) alpha = standPat;
+    if (ply >= MAX_PLY) return standPat;
+
+    vector<Move> moves;
+    generateLegalMoves(whiteTurn, moves);
+    moves.erase(remove_if(moves.begin(), moves.end(), [](const Move& m) { return !m.capture; }), moves.end());
+    orderMoves(moves);
+    for (const Move& m : moves) {
+        Undo u = makeMove(m);
+        int score = -quiescence(ctx, -beta, -alpha, ply + 1);
+        undoMove(u);
+        if (ctx.aborted) return 0;
+        if (score >= beta) return score;
+        if (score > alpha) alpha = score;
+    }
+    return alpha;
+}
+
+int negamax(SearchContext& ctx, int depth, int alpha, int beta, int ply) {
+    if (timeUp(ctx)) return 0;
+
+    vector<Move> moves;
+    generateLegalMoves(whiteTurn, moves);
+    if (moves.empty()) return isKingInCheck(whiteTurn) ? -MATE + ply : 0;
+    if (depth <= 0 || ply >= MAX_PLY) return quiescence(ctx, alpha, beta, ply);
+
+    orderMoves(moves);
+    int best = -MATE;
+    for (const Move& m : moves) {
+        Undo u = makeMove(m);
+        int score = -negamax(ctx, depth - 1, -beta, -alpha, ply + 1);
+        undoMove(u);
+        if (ctx.aborted) return 0;
+        if (score > best) best = score;
+        if (score > alpha) alpha = score;
+        if (alpha >= beta) break;
+    }
+    return best;
+}
+
+//////////  SECTION: SOLVING ONE POSITION  //////////
+struct EpdResult {
+    bool loaded = false;
+    bool unsupported = false;
+    bool solved = false;
+    string found;
+    int depth = 0;
+    int score = 0;
+    long long nodes = 0;
+    double solveMs = -1.0;
+    double elapsedMs = 0.0;
+};
+
+double msSince(Clock::time_point start) {
+    return chrono::duration<double, milli>(Clock::now() - start).count();
+}
+
+bool matchesAny(const string& san, const vector<string>& list) {
+    return find(list.begin(), list.end(), san) != list.end();
+}
+
+bool isCorrect(const EpdEntry& e, const string& san) {
+    if (!e.bestMoves.empty() && !matchesAny(san, e.bestMoves)) return false;
+    return !matchesAny(san, e.avoidMoves);
+}
+
+EpdResult solvePosition(const EpdEntry& e, int timeMs, int maxDepth) {
+    EpdResult res;
+    Clock::time_point start = Clock::now();
+    if (!loadFen(e.fen)) return res;
+    res.loaded = true;
+
+    SearchContext ctx;
+    ctx.deadline = start + chrono::milliseconds(timeMs);
+
+    vector<Move> rootMoves;
+    generateLegalMoves(whiteTurn, rootMoves);
+    if (rootMoves.empty()) return res;
+    orderMoves(rootMoves);
+    vector<string> rootSan;
+    for (const Move& m : rootMoves) rootSan.push_back(moveToSan(m, rootMoves));
+
+    for (const string& m : e.bestMoves) if (!matchesAny(m, rootSan)) { res.unsupported = true; return res; }
+    for (const string& m : e.avoidMoves) if (!matchesAny(m, rootSan)) { res.unsupported = true; return res; }
+
+    bool wasCorrect = false;
+    for (int depth = 1; depth <= maxDepth; ++depth) {
+        int alpha = -MATE - 1, beta = MATE + 1;
+        int bestIdx = -1, bestScore = -MATE - 1;
+        for (size_t i = 0; i < rootMoves.size(); ++i) {
+            Undo u = makeMove(rootMoves[i]);
+            int score = -negamax(ctx, depth - 1, -beta, -alpha, 1);
+            undoMove(u);
+            if (ctx.aborted) break;
+            if (score > bestScore) { bestScore = score; bestIdx = int(i); }
+            if (score > alpha) alpha = score;
+        }
+        if (ctx.aborted || bestIdx == -1) break;
+
+        // Keep the previous best first so the next iteration searches it first.
+        rotate(rootMoves.begin(), rootMoves.begin() + bestIdx, rootMoves.begin() + bestIdx + 1);
+        rotate(rootSan.begin(), rootSan.begin() + bestIdx, rootSan.begin() + bestIdx + 1);
+
+        res.found = rootSan[0];
+        res.depth = depth;
+        res.score = bestScore;
+        bool correct = isCorrect(e, res.found);
+        if (correct && !wasCorrect) res.solveMs = msSince(start);
+        wasCorrect = correct;
+
+        if (abs(bestScore) >= MATE - MAX_PLY) break; // forced mate found, deeper won't change it
+    }
+
+    res.solved = wasCorrect;
+    if (!res.solved) res.solveMs = -1.0;
+    res.nodes = ctx.nodes;
+    res.elapsedMs = msSince(start);
+    return res;
+}
+
+//////////  SECTION: MAIN  //////////
+int main(int argc, char** argv) {
+    string path;
+    int threads = int(thread::hardware_concurrency());
+    int timeMs = 1000, maxDepth = MAX_PLY;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--threads" && hasValue) threads = atoi(argv[++i]);
+        else if (arg == "--time" && hasValue) timeMs = max(1, atoi(argv[++i]));
+        else if (arg == "--depth" && hasValue) maxDepth = max(1, min(MAX_PLY, atoi(argv[++i])));
+        else if (path.empty() && arg[0] != '-') path = arg;
+        else {
+            cout << "usage: " << argv[0] << " FILE.epd [--threads N] [--time MS] [--depth N]" << endl;
+            return 2;
+        }
+    }
+    if (path.empty()) {
+        cout << "usage: " << argv[0] << " FILE.epd [--threads N] [--time MS] [--depth N]" << endl;
+        return 2;
+    }
+    if (threads < 1) threads = 1;
+
+    vector<string> lines;
+    if (!readLines(path, lines)) return 1;
+    vector<EpdEntry> entries;
+    for (const string& line : lines) {
+        EpdEntry e;
+        if (!parseEpd(line, e)) {
+            cout << "Skipping bad EPD line: " << line << endl;
+            continue;
+        }
+        if (e.id.empty()) e.id = "#" + to_string(entries.size() + 1);
+        entries.push_back(e);
+    }
+    if (entries.empty()) {
+        cout << "No positions in " << path << endl;
+        return 1;
+    }
+
+    // Thread pool: each worker takes the next unsolved position until none are left.
+    vector<EpdResult> results(entries.size());
+    atomic<size_t> next(0);
+    Clock::time_point suiteStart = Clock::now();
+    vector<thread> workers;
+    int workerCount = min(threads, int(entries.size()));
+    for (int t = 0; t < workerCount; ++t) {
+        workers.emplace_back([&]() {
+            for (size_t i = next++; i < entries.size(); i = next++) results[i] = solvePosition(entries[i], timeMs, maxDepth);
+            });
+    }
+    for (thread& w : workers) w.join();
+    double wallMs = msSince(suiteStart);
+
+    // Text columns are sized from the data so long ids never run into the next column.
+    vector<string> expectedText(entries.size());
+    size_t idWidth = 2, expectedWidth = 8;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const EpdEntry& e = entries[i];
+        string& expected = expectedText[i];
+        for (const string& m : e.bestMoves) expected += (expected.empty() ? "" : " ") + m;
+        for (const string& m : e.avoidMoves) expected += (expected.empty() ? "!" : " !") + m;
+        idWidth = max(idWidth, e.id.size());
+        expectedWidth = max(expectedWidth, expected.size());
+    }
+    idWidth += 2;
+    expectedWidth += 2;
+
+    int solved = 0, unsupported = 0;
+    long long totalNodes = 0;
+    double totalSolveMs = 0.0;
+    cout << left << setw(int(idWidth)) << "id" << setw(13) << "result" << setw(10) << "found" << setw(int(expectedWidth)) << "expected"
+         << right << setw(6) << "depth" << setw(12) << "solve ms" << setw(12) << "nodes" << endl;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const EpdEntry& e = entries[i];
+        const EpdResult& r = results[i];
+        const string& expected = expectedText[i];
+
+        string status = !r.loaded ? "BADFEN" : (r.unsupported ? "UNSUPPORTED" : (r.solved ? "ok" : "FAIL"));
+        cout << left << setw(int(idWidth)) << e.id << setw(13) << status << setw(10) << (r.found.empty() ? "-" : r.found)
+             << setw(int(expectedWidth)) << expected << right << setw(6) << r.depth << fixed << setprecision(1)
+             << setw(12) << (r.solved ? r.solveMs : 0.0) << setw(12) << r.nodes << endl;
+
+        totalNodes += r.nodes;
+        if (r.unsupported) ++unsupported;
+        if (r.solved) { ++solved; totalSolveMs += r.solveMs; }
+    }
+
+    double wallSec = wallMs / 1000.0;
+    cout << endl;
+    int scored = int(entries.size()) - unsupported;
+    cout << "solved:     " << solved << " / " << scored << endl;
+    if (unsupported) cout << "unsupported: " << unsupported << " (bm/am not playable under these rules, not scored)" << endl;
+    cout << fixed << setprecision(1);
+    cout << "avg solve:  " << (solved ? totalSolveMs / solved : 0.0) << " ms" << endl;
+    cout << "threads:    " << workerCount << ", time limit " << timeMs << " ms/position" << endl;
+    cout << "wall time:  " << wallMs << " ms" << endl;
+    cout << "throughput: " << (wallSec > 0 ? double(entries.size()) / wallSec : 0.0) << " positions/s, "
+         << setprecision(0) << (wallSec > 0 ? double(totalNodes) / wallSec : 0.0) << " nodes/s" << endl;
+    return solved == scored ? 0 : 1;
+}
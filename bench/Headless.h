@@ -0,0 +1,136 @@
+// Rules-only build of the game for the tools in this folder.
+// Pulls in FinalChessGame.cpp without SFML and adds a few helpers
+// (legal move list, make/undo, SAN) on top of the existing rules.
+#pragma once
+
+#define CHESS_HEADLESS
+#include "../FinalChessGame.cpp"
+
+#include <fstream>
+#include <vector>
+
+//////////  SECTION: MOVES  //////////
+struct Move {
+    int pieceIdx;
+    int fromR, fromC;
+    int toR, toC;
+    bool capture;
+};
+
+struct Undo {
+    Move move;
+    char destChar;
+    int capturedIdx;
+    bool hasMoved;
+};
+
+Undo makeMove(const Move& m) {
+    Undo u;
+    u.move = m;
+    u.destChar = boardArr[m.toR][m.toC];
+    u.capturedIdx = m.capture ? findPieceIndexAt(m.toR, m.toC) : -1;
+    u.hasMoved = pieces[m.pieceIdx].hasMoved;
+
+    if (u.capturedIdx != -1) pieces[u.capturedIdx].alive = false;
+    boardArr[m.fromR][m.fromC] = '.';
+    boardArr[m.toR][m.toC] = pieceToBoardChar(pieces[m.pieceIdx]);
+    pieces[m.pieceIdx].row = m.toR;
+    pieces[m.pieceIdx].col = m.toC;
+    pieces[m.pieceIdx].hasMoved = true;
+    whiteTurn = !whiteTurn;
+    return u;
+}
+
+void undoMove(const Undo& u) {
+    const Move& m = u.move;
+    Piece& p = pieces[m.pieceIdx];
+    p.row = m.fromR;
+    p.col = m.fromC;
+    p.hasMoved = u.hasMoved;
+    boardArr[m.fromR][m.fromC] = pieceToBoardChar(p);
+    boardArr[m.toR][m.toC] = u.destChar;
+    if (u.capturedIdx != -1) pieces[u.capturedIdx].alive = true;
+    whiteTurn = !whiteTurn;
+}
+
+// Same pattern walk + king-safety filter as hasAnyLegalMoves, but collects
+// every legal move instead of stopping at the first one.
+void generateLegalMoves(bool turnWhite, vector<Move>& out) {
+    out.clear();
+    for (int i = 0; i < pieceCount; ++i) {
+        if (!pieces[i].alive || pieces[i].white != turnWhite) continue;
+        calculateValidMoves(i);
+        bool quiet[8][8], capture[8][8];
+        for (int r = 0; r < 8; ++r) for (int c = 0; c < 8; ++c) { quiet[r][c] = validMoves[r][c]; capture[r][c] = captureMoves[r][c]; }
+
+        for (int r = 0; r < 8; ++r) {
+            for (int c = 0; c < 8; ++c) {
+                if (!quiet[r][c] && !capture[r][c]) continue;
+                Move m{ i, pieces[i].row, pieces[i].col, r, c, capture[r][c] };
+                Undo u = makeMove(m);
+                bool inCheck = isKingInCheck(turnWhite);
+                undoMove(u);
+                if (!inCheck) out.push_back(m);
+            }
+        }
+    }
+}
+
+//////////  SECTION: SAN  //////////
+string squareName(int r, int c) {
+    string s;
+    s += char('a' + c);
+    s += char('0' + (BOARD_N - r));
+    return s;
+}
+
+// No castling, promotion or en passant: the rules above don't have them.
+string moveToSan(const Move& m, const vector<Move>& legal) {
+    const Piece& p = pieces[m.pieceIdx];
+    string san;
+    if (p.type == 'P') {
+        if (m.capture) { san += char('a' + m.fromC); san += 'x'; }
+        return san + squareName(m.toR, m.toC);
+    }
+
+    san += p.type;
+    bool clash = false, sameFile = false, sameRank = false;
+    for (const Move& o : legal) {
+        if (o.pieceIdx == m.pieceIdx || o.toR != m.toR || o.toC != m.toC) continue;
+        if (pieces[o.pieceIdx].type != p.type) continue;
+        clash = true;
+        if (o.fromC == m.fromC) sameFile = true;
+        if (o.fromR == m.fromR) sameRank = true;
+    }
+    if (clash) {
+        if (!sameFile) san += char('a' + m.fromC);
+        else if (!sameRank) san += char('0' + (BOARD_N - m.fromR));
+        else san += squareName(m.fromR, m.fromC);
+    }
+    if (m.capture) san += 'x';
+    return san + squareName(m.toR, m.toC);
+}
+
+// Drops check/mate marks and annotations so "Qxf7#" matches "Qxf7".
+string stripSan(const string& san) {
+    string s;
+    for (char ch : san) if (ch != '+' && ch != '#' && ch != '!' && ch != '?') s += ch;
+    return s;
+}
+
+//////////  SECTION: FILE HELPERS  //////////
+// Non-empty lines that don't start with '#'.
+bool readLines(const string& path, vector<string>& out) {
+    ifstream in(path);
+    if (!in) {
+        cout << "Could not open " << path << endl;
+        return false;
+    }
+    string line;
+    while (getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty() || line[0] == '#') continue;
+        out.push_back(line);
+    }
+    return true;
+}